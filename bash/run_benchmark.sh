@@ -0,0 +1,227 @@
+#!/bin/bash
+#Throughput baseline on synthetic gammaJetTree_p from bin/gdjToyGammaJetTree.exe
+#Runs toy generation -> preProc -> gdjNTupleToHist -> photon purity (+ photon eff and jetEnergy for MC) per sample
+#gdjNTupleToHist also runs w/ NTHREADS=4 and must match the serial output bin for bin (bin/testHistFileMatch.exe), else the script exits 1
+#Data must match exactly; MC weighted sums are float and summed in a different order per NTHREADS, so MC is matched to a relative 1e-5
+#w/ DOMIX the serial run draws mixed events from one running TRandom3, the threaded runs per entry, so there NTHREADS=4 is matched against NTHREADS=2
+#gdjNTupleToHist also runs w/ GENERICKERNEL: 1, and the 'event loop' stage of the four samples (one per <ISPP, ISMC, DOMIX>) is compared to the specialized kernel
+#The generic output must match the specialized serial one exactly, DOMIX included since both draw from the same serial TRandom3, else the script exits 1
+#and prints events/sec and peak RSS per stage; configs are in input/benchmark/, everything is written under output/benchmark/
+
+if [ $# -gt 1 ]; then
+    echo "Usage: ./bash/run_benchmark.sh <nEvtPerSample (default 20000)>"
+    exit 1
+fi
+
+NEVT=20000
+if [ $# -eq 1 ]; then
+    NEVT=$1
+fi
+
+SAMPLES="PbPbData PbPbMC PPData PPMC"
+TOPDIR=output/benchmark
+CONFDIR=$TOPDIR/configs
+LOGDIR=$TOPDIR/logs
+SUMMARY=$TOPDIR/benchmark_summary.txt
+THREADMATCH=$TOPDIR/benchmark_threadMatch.txt
+THREADMATCHSTATUS=0
+KERNELTIME=$TOPDIR/benchmark_kernelTime.txt
+
+TIMECMD=""
+if [ -x /usr/bin/time ]; then
+    TIMECMD="/usr/bin/time"
+else
+    echo "WARNING: /usr/bin/time not found, peak RSS will not be reported"
+fi
+
+#fresh start so the recursive input file lists only see this pass
+rm -rf $TOPDIR/toy $TOPDIR/preProc $CONFDIR $LOGDIR output/benchmark/phoTagJetRaa_*
+mkdir -p $TOPDIR/calib $CONFDIR $LOGDIR
+for S in $SAMPLES
+do
+    mkdir -p $TOPDIR/toy/$S $TOPDIR/preProc/$S
+done
+
+printf "%-26s %-9s %9s %10s %12s %14s %s\n" "Stage" "Sample" "Events" "Wall [s]" "Events/s" "Peak RSS [MB]" "Status" > $SUMMARY
+rm -f $THREADMATCH
+printf "%-9s %-22s %16s %14s %10s %s\n" "Sample" "<isPP, isMC, doMix>" "Specialized [s]" "Generic [s]" "Speedup" "Output" > $KERNELTIME
+
+#runStage <stage> <sample> <exe> <config>
+runStage () {
+    STAGE=$1
+    S=$2
+    EXE=$3
+    CONF=$4
+    LOG=$LOGDIR/${STAGE}_${S}.log
+
+    if [ ! -x $EXE ]; then
+	printf "%-26s %-9s %9s %10s %12s %14s %s\n" $STAGE $S $NEVT "-" "-" "-" "NOT BUILT" >> $SUMMARY
+	return
+    fi
+
+    echo "Running $STAGE for $S..."
+    TIMEFILE=$LOGDIR/${STAGE}_${S}.time
+    START=`date +%s.%N`
+    if [ "$TIMECMD" != "" ]; then
+	DOGLOBALTIMINGROOT=1 GLOBALTIMINGJSON=$LOGDIR/${STAGE}_${S}.json $TIMECMD -f "%e %M" -o $TIMEFILE $EXE $CONF >& $LOG
+	STATUS=$?
+	#last line; a failing command adds an 'exited with non-zero status' line first
+	read WALL RSSKB <<< "`tail -n 1 $TIMEFILE`"
+    else
+	DOGLOBALTIMINGROOT=1 GLOBALTIMINGJSON=$LOGDIR/${STAGE}_${S}.json $EXE $CONF >& $LOG
+	STATUS=$?
+	END=`date +%s.%N`
+	WALL=`awk -v s=$START -v e=$END 'BEGIN{printf "%.2f", e-s}'`
+	RSSKB=""
+    fi
+
+    RATE=`awk -v n=$NEVT -v t=$WALL 'BEGIN{if(t > 0) printf "%.1f", n/t; else print "-"}'`
+    RSSMB="-"
+    if [ "$RSSKB" != "" ]; then
+	RSSMB=`awk -v k=$RSSKB 'BEGIN{printf "%.1f", k/1024.}'`
+    fi
+
+    STATUSSTR="OK"
+    if [ $STATUS -ne 0 ]; then
+	STATUSSTR="FAILED ($LOG)"
+    fi
+    printf "%-26s %-9s %9s %10s %12s %14s %s\n" $STAGE $S $NEVT $WALL $RATE $RSSMB "$STATUSSTR" >> $SUMMARY
+}
+
+#'event loop' stage seconds from a stageTimer json, '-' if absent
+eventLoopSeconds () {
+    SEC=`grep "\"name\": \"event loop\"" $1 2> /dev/null | sed -e "s@.*\"seconds\": \([^}]*\)}.*@\1@g"`
+    if [ "$SEC" == "" ]; then
+	SEC="-"
+    fi
+    echo $SEC
+}
+
+#newest preProc output of a sample
+preProcFile () {
+    ls -t $TOPDIR/preProc/$1/*/*.root 2> /dev/null | head -n 1
+}
+
+###### toy generation and preProc; PbPbData goes first since its preProc output is the PbPb mixing file
+for S in $SAMPLES
+do
+    sed -e "s@^NEVT:.*@NEVT: $NEVT@g" input/benchmark/toyGammaJetTree_$S.config > $CONFDIR/toyGammaJetTree_$S.config
+    runStage gdjToyGammaJetTree $S ./bin/gdjToyGammaJetTree.exe $CONFDIR/toyGammaJetTree_$S.config
+    runStage gdjNtuplePreProc $S ./bin/gdjNtuplePreProc_phoTaggedJetRaa.exe input/benchmark/ntuplePreProc_$S.config
+done
+
+###### downstream
+MIXFILE=`preProcFile PbPbData`
+for S in $SAMPLES
+do
+    INFILE=`preProcFile $S`
+    sed -e "s@BENCHMARKINFILE@$INFILE@g" -e "s@BENCHMARKMIXFILE@$MIXFILE@g" input/benchmark/ntupleToHist_$S.config > $CONFDIR/ntupleToHist_$S.config
+    runStage gdjNTupleToHist $S ./bin/gdjNTupleToHist.exe $CONFDIR/ntupleToHist_$S.config
+
+    #NTHREADS=4 must reproduce the serial output bin for bin; w/ DOMIX the reference is NTHREADS=2, the mixed event draws of the serial loop differ by design
+    sed -e "s@^NTHREADS:.*@NTHREADS: 4@g" -e "s@^OUTFILENAME: \(.*\)\.root@OUTFILENAME: \1_nThreads4.root@g" $CONFDIR/ntupleToHist_$S.config > $CONFDIR/ntupleToHist_${S}_nThreads4.config
+    runStage gdjNTupleToHistNThreads4 $S ./bin/gdjNTupleToHist.exe $CONFDIR/ntupleToHist_${S}_nThreads4.config
+    SERIALFILE=`ls -t output/*/benchmark_ntupleToHist_${S}_[0-9]*.root 2> /dev/null | head -n 1`
+    THREADFILE=`ls -t output/*/benchmark_ntupleToHist_${S}_nThreads4_*.root 2> /dev/null | head -n 1`
+    if [ "`grep "^DOMIX:" $CONFDIR/ntupleToHist_$S.config | sed -e "s@.*: *@@g"`" == "1" ]; then
+	sed -e "s@^NTHREADS:.*@NTHREADS: 2@g" -e "s@^OUTFILENAME: \(.*\)\.root@OUTFILENAME: \1_nThreads2.root@g" $CONFDIR/ntupleToHist_$S.config > $CONFDIR/ntupleToHist_${S}_nThreads2.config
+	runStage gdjNTupleToHistNThreads2 $S ./bin/gdjNTupleToHist.exe $CONFDIR/ntupleToHist_${S}_nThreads2.config
+	SERIALFILE=`ls -t output/*/benchmark_ntupleToHist_${S}_nThreads2_*.root 2> /dev/null | head -n 1`
+    fi
+    #unweighted data counts are exact in float, MC weights are not
+    RELTOL=0
+    if [[ $S == *MC ]]; then
+	RELTOL=1e-5
+    fi
+    if [ ! -x ./bin/testHistFileMatch.exe ]; then
+	printf "%-9s %s\n" $S "NOT BUILT" >> $THREADMATCH
+    elif [ "$SERIALFILE" == "" ] || [ "$THREADFILE" == "" ]; then
+	printf "%-9s %s\n" $S "NO OUTPUT" >> $THREADMATCH
+    elif ./bin/testHistFileMatch.exe $SERIALFILE $THREADFILE $RELTOL >& $LOGDIR/threadMatch_$S.log; then
+	printf "%-9s %s\n" $S "MATCH (`tail -n 1 $LOGDIR/threadMatch_$S.log`)" >> $THREADMATCH
+    else
+	printf "%-9s %s\n" $S "MISMATCH ($LOGDIR/threadMatch_$S.log)" >> $THREADMATCH
+	THREADMATCHSTATUS=1
+    fi
+
+    #same config through the generic kernel, i.e. the mode flags tested per entry instead of compiled away
+    sed -e "s@^OUTFILENAME: \(.*\)\.root@OUTFILENAME: \1_generic.root@g" $CONFDIR/ntupleToHist_$S.config > $CONFDIR/ntupleToHist_${S}_generic.config
+    echo "GENERICKERNEL: 1" >> $CONFDIR/ntupleToHist_${S}_generic.config
+    runStage gdjNTupleToHistGeneric $S ./bin/gdjNTupleToHist.exe $CONFDIR/ntupleToHist_${S}_generic.config
+    MODE="<"
+    for KEY in ISPP ISMC DOMIX
+    do
+	MODE="$MODE`grep "^$KEY:" $CONFDIR/ntupleToHist_$S.config | sed -e "s@.*: *@@g"`"
+	if [ $KEY != DOMIX ]; then
+	    MODE="$MODE, "
+	fi
+    done
+    MODE="$MODE>"
+    SPECSEC=`eventLoopSeconds $LOGDIR/gdjNTupleToHist_$S.json`
+    GENSEC=`eventLoopSeconds $LOGDIR/gdjNTupleToHistGeneric_$S.json`
+    SPEEDUP=`awk -v s=$SPECSEC -v g=$GENSEC 'BEGIN{if(s > 0 && g > 0) printf "%.3f", g/s; else print "-"}'`
+    #same serial loop and summation order, so even MC has to match bin for bin
+    SPECFILE=`ls -t output/*/benchmark_ntupleToHist_${S}_[0-9]*.root 2> /dev/null | head -n 1`
+    GENFILE=`ls -t output/*/benchmark_ntupleToHist_${S}_generic_*.root 2> /dev/null | head -n 1`
+    if [ ! -x ./bin/testHistFileMatch.exe ]; then
+	KERNELMATCH="NOT BUILT"
+    elif [ "$SPECFILE" == "" ] || [ "$GENFILE" == "" ]; then
+	KERNELMATCH="NO OUTPUT"
+    elif ./bin/testHistFileMatch.exe $SPECFILE $GENFILE 0 >& $LOGDIR/kernelMatch_$S.log; then
+	KERNELMATCH="MATCH"
+    else
+	KERNELMATCH="MISMATCH ($LOGDIR/kernelMatch_$S.log)"
+	THREADMATCHSTATUS=1
+    fi
+    printf "%-9s %-22s %16s %14s %10s %s\n" $S "$MODE" $SPECSEC $GENSEC $SPEEDUP "$KERNELMATCH" >> $KERNELTIME
+
+    #R=0.2 and R=0.4 of the same skim in one fan-out run (skim read once into a temporary columnar cache, then one fill pass per config)
+    for R in 2 4
+    do
+	sed -e "s@^JETR:.*@JETR: $R@g" -e "s@^OUTFILENAME: \(.*\)\.root@OUTFILENAME: \1_fanOutR$R.root@g" $CONFDIR/ntupleToHist_$S.config > $CONFDIR/ntupleToHist_${S}_fanOutR$R.config
+    done
+    runStage gdjNTupleToHistFanOut $S ./bin/gdjNTupleToHist.exe "$CONFDIR/ntupleToHist_${S}_fanOutR2.config $CONFDIR/ntupleToHist_${S}_fanOutR4.config"
+
+    runStage photonPurity $S ./bin/phoTaggedJetRaa_photonPurity.exe input/benchmark/phoTagJetRaa_$S.config
+
+    if [[ $S == *MC ]]; then
+	runStage photonEff $S ./bin/phoTaggedJetRaa_photonEff.exe input/benchmark/phoTagJetRaa_$S.config
+	runStage jetEnergy $S ./bin/phoTaggedJetRaa_jetEnergy.exe input/benchmark/phoTagJetRaa_$S.config
+    fi
+done
+
+###### toy multi-jet mixing, NEVT toys over 4 threads
+sed -e "s@^NEVT:.*@NEVT: $NEVT@g" input/benchmark/toyMultiMix.config > $CONFDIR/toyMultiMix.config
+runStage gdjToyMultiMix Toy ./bin/gdjToyMultiMix.exe $CONFDIR/toyMultiMix.config
+
+echo ""
+echo "BENCHMARK SUMMARY ($NEVT generated events per sample; logs and stageTimer json in $LOGDIR)"
+cat $SUMMARY
+
+echo ""
+echo "SERIAL (NTHREADS=2 W/ DOMIX) VS NTHREADS=4 gdjNTupleToHist OUTPUT"
+cat $THREADMATCH
+
+#skim size per sample, e.g. w/ and w/o SYSPACKED in the MC preProc configs
+echo ""
+echo "PREPROC SKIM SIZES"
+for S in $SAMPLES
+do
+    INFILE=`preProcFile $S`
+    if [ "$INFILE" != "" ]; then
+	printf "%-9s %10s MB %s\n" $S `du -m $INFILE | cut -f 1` $INFILE
+    fi
+done
+
+#event loop instantiation each stage dispatched to, to tie the rates above to the compiled mode
+echo ""
+echo "EVENT LOOP KERNELS"
+grep -H "Event loop kernel" $LOGDIR/*.log 2> /dev/null | sed -e "s@$LOGDIR/@@g" -e "s@\.log:@: @g"
+
+#serial 'event loop' stage and output, specialized vs. generic kernel; speedup = generic/specialized
+echo ""
+echo "SPECIALIZED VS GENERIC EVENT LOOP KERNEL"
+cat $KERNELTIME
+
+#non-zero if any threaded or generic kernel output differs from the serial specialized one
+exit $THREADMATCHSTATUS
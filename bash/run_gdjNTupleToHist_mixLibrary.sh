@@ -0,0 +1,36 @@
+#!/bin/bash
+export DOGLOBALDEBUGROOT=0
+DATE=`date +%Y%m%d`
+
+if [ $# -lt 1 ]; then
+  echo "Usage: ./bash/run_gdjNTupleToHist_mixLibrary.sh <inConfigFileName> <more configs w/ the same MIXLIBRARYNAME, optional>"
+  exit 1
+fi
+
+mkdir -p ./log/hist
+
+##### build the mixing library once (no-op if it is already up to date), every job then maps it read-only
+NAME=`basename $1 .config`
+./bin/gdjNTupleToHist.exe $1 MIXLIBRARY >& ./log/hist/${NAME}_${DATE}_MixLibrary.log
+if [ $? -ne 0 ]; then
+    echo "Mixing library build failed, check ./log/hist/${NAME}_${DATE}_MixLibrary.log"
+    exit 1
+fi
+
+PIDS=""
+for CONFIG in "$@"; do
+    NAME=`basename $CONFIG .config`
+    ./bin/gdjNTupleToHist.exe $CONFIG >& ./log/hist/${NAME}_${DATE}.log &
+    PIDS="$PIDS $!"
+done
+
+FAILED=0
+for PID in $PIDS; do
+    wait $PID || FAILED=1
+done
+
+if [ $FAILED -ne 0 ]; then
+    echo "At least one job failed, check ./log/hist/*_${DATE}.log"
+    exit 1
+fi
+echo "DONE, see ./log/hist/"
@@ -0,0 +1,40 @@
+#!/bin/bash
+export DOGLOBALDEBUGROOT=0
+#one date for every shard and the merge, so a run across midnight still writes and merges in the same output/<DATE>
+DATE=`date +%Y%m%d`
+
+if [ $# -lt 1 ]; then
+  echo "Usage: ./bash/run_phoTagJetRaa_skim_parallel.sh <inConfigFileName> <nShards, default 8>"
+  exit 1
+fi
+
+CONFIG=$1
+NSHARDS=8
+if [ $# -ge 2 ]; then
+    NSHARDS=$2
+fi
+NAME=`basename $CONFIG .config`
+echo "./bin/gdjNtuplePreProc_phoTaggedJetRaa.exe $CONFIG in $NSHARDS shards"
+
+mkdir -p ./log/skim
+
+##### one process per block of input files, each writes its own chunk
+PIDS=""
+for (( SHARD=0; SHARD<$NSHARDS; SHARD++ )); do
+    ./bin/gdjNtuplePreProc_phoTaggedJetRaa.exe $CONFIG $SHARD $NSHARDS $DATE >& ./log/skim/${NAME}_${DATE}_Shard${SHARD}of${NSHARDS}.log &
+    PIDS="$PIDS $!"
+done
+
+FAILED=0
+for PID in $PIDS; do
+    wait $PID || FAILED=1
+done
+
+if [ $FAILED -ne 0 ]; then
+    echo "At least one shard failed, check ./log/skim/${NAME}_${DATE}_Shard*of${NSHARDS}.log. Shards are not merged."
+    exit 1
+fi
+
+##### merge chunks in shard order, entry ordering is the same as the serial job
+./bin/gdjNtuplePreProc_phoTaggedJetRaa.exe $CONFIG MERGE $NSHARDS $DATE >& ./log/skim/${NAME}_${DATE}.log
+echo "DONE, see ./log/skim/${NAME}_${DATE}.log"
@@ -0,0 +1,49 @@
+#ifndef BAYESUNFOLD_H
+#define BAYESUNFOLD_H
+
+//c+cpp
+#include <vector>
+
+//Iterative Bayesian (D'Agostini) unfolding on dense, gen-major matrices or sparse, reco-major CSR ones
+//The dense response is given as counts, response[genPos*nReco + recoPos], i.e. h2D_genPt_recoPt (x reco, y gen) read row by row in gen
+//The sparse one as CSR rows over reco (sparseResponse::GetCSR), so fold and update only touch the non-zero bins
+//P(reco | gen) is the response over the truth count of that gen bin if one is given, else over the gen projection (efficiency 1)
+//Both layouts sum every bin in the same order, so a sparse response unfolds to exactly the result of its dense copy
+class bayesUnfold{
+ public:
+  bayesUnfold(){};
+  bayesUnfold(unsigned int in_nReco, unsigned int in_nGen, const std::vector<double>& in_response, const std::vector<double>& in_truth = std::vector<double>());
+  ~bayesUnfold();
+
+  bool Init(unsigned int in_nReco, unsigned int in_nGen, const std::vector<double>& in_response, const std::vector<double>& in_truth = std::vector<double>());
+  //Reco row r holds gen positions in_col[in_rowPtr[r], in_rowPtr[r+1]) w/ counts in_response at the same positions
+  bool InitSparse(unsigned int in_nReco, unsigned int in_nGen, const std::vector<unsigned long long>& in_rowPtr, const std::vector<int>& in_col, const std::vector<double>& in_response, const std::vector<double>& in_truth = std::vector<double>());
+  //Defaults to the gen projection of the response
+  bool SetPrior(const std::vector<double>& in_prior);
+
+  //Iterations 1..in_nIter go to out_unfolded at [(iter-1)*nGen + genPos], so one call covers an iteration scan
+  bool Unfold(const std::vector<double>& in_measured, unsigned int in_nIter, std::vector<double>* out_unfolded) const;
+  //Folds a gen spectrum back to reco, for closure checks
+  bool Fold(const std::vector<double>& in_gen, std::vector<double>* out_reco) const;
+
+  bool GetIsInit() const;
+  bool GetIsSparse() const;
+  unsigned int GetNReco() const;
+  unsigned int GetNGen() const;
+  const std::vector<double>& GetPrior() const;
+  const std::vector<double>& GetEfficiency() const;
+  void Clean();
+
+ private:
+  bool m_isInit = false;
+  bool m_isSparse = false;
+  unsigned int m_nReco = 0;
+  unsigned int m_nGen = 0;
+  std::vector<double> m_prob;//P(reco | gen), gen-major if dense, per non-zero bin if sparse
+  std::vector<unsigned long long> m_rowPtr;//sparse only
+  std::vector<int> m_col;//sparse only
+  std::vector<double> m_eff;//sum over reco of P(reco | gen)
+  std::vector<double> m_prior;
+};
+
+#endif
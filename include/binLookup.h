@@ -0,0 +1,193 @@
+#ifndef BINLOOKUP_H
+#define BINLOOKUP_H
+
+//cpp
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+//ROOT
+#include "TMath.h"
+
+//Precomputed replacement for ghostPos(), same bin assignment incl. out of bounds handling
+//Uniform bins use arithmetic + an exact edge check, variable bins use binary search
+class binLookup
+{
+ public:
+  binLookup(){return;}
+  binLookup(std::vector<float> inBins){Init(inBins);}
+  binLookup(Int_t nBins, Double_t inBins[]){Init(nBins, inBins);}
+  binLookup(std::vector<int> inBins){Init(inBins);}
+  ~binLookup(){};
+
+  bool Init(std::vector<float> inBins);
+  bool Init(Int_t nBins, Double_t inBins[]);
+  bool Init(std::vector<int> inBins);
+  inline int GetPos(double inVal, bool failBounds=true, bool printWarnings=false) const;
+  int GetNBins() const {return ((int)m_bins.size())-1;}
+  bool GetIsUniform() const {return m_isUniform;}
+
+ private:
+  bool InitFromEdges();
+
+  std::vector<double> m_bins;
+  bool m_isUniform = false;
+  double m_invWidth = 0.0;
+};
+
+//Edges are held as double but filled from float, matching the float compare in ghostPos()
+inline bool binLookup::Init(std::vector<float> inBins)
+{
+  m_bins.clear();
+  for(unsigned int bI = 0; bI < inBins.size(); ++bI){
+    m_bins.push_back(inBins[bI]);
+  }
+  return InitFromEdges();
+}
+
+inline bool binLookup::Init(Int_t nBins, Double_t inBins[])
+{
+  m_bins.clear();
+  for(Int_t bI = 0; bI < nBins+1; ++bI){
+    m_bins.push_back((float)inBins[bI]);
+  }
+  return InitFromEdges();
+}
+
+inline bool binLookup::Init(std::vector<int> inBins)
+{
+  m_bins.clear();
+  for(unsigned int bI = 0; bI < inBins.size(); ++bI){
+    m_bins.push_back(inBins[bI]);
+  }
+  return InitFromEdges();
+}
+
+inline bool binLookup::InitFromEdges()
+{
+  m_isUniform = false;
+  if(m_bins.size() < 2) return m_bins.size() != 0;
+
+  const double width = (m_bins[m_bins.size()-1] - m_bins[0])/(double)(m_bins.size()-1);
+  if(width <= 0) return true;
+
+  //Near-uniform is enough (e.g. getLinBins w/ float interval), GetPos corrects to the exact edge
+  m_isUniform = true;
+  for(unsigned int bI = 0; bI < m_bins.size()-1; ++bI){
+    if(TMath::Abs((m_bins[bI+1] - m_bins[bI]) - width) > width*0.001){
+      m_isUniform = false;
+      break;
+    }
+  }
+  if(m_isUniform) m_invWidth = 1./width;
+
+  return true;
+}
+
+inline int binLookup::GetPos(double inVal, bool failBounds, bool printWarnings) const
+{
+  if(m_bins.size() == 0){
+    std::cout << "BINLOOKUP GETPOS ERROR: Given bins have size \'0\'. returning int32 max for absurd result" << std::endl;
+    return 2147483647;
+  }
+
+  const int nBins = m_bins.size()-1;
+  if(inVal < m_bins[0]){
+    if(printWarnings) std::cout << "WARNING BINLOOKUP GETPOS: Given value \'" << inVal << "\' falls below binning (low edge \'" << m_bins[0] << "\'). return pos 0" << std::endl;
+    if(!failBounds) return 0;
+    return -1;
+  }
+  else if(inVal >= m_bins[nBins]){
+    if(printWarnings) std::cout << "WARNING BINLOOKUP GETPOS: Given value \'" << inVal << "\' is above binning (high edge \'" << m_bins[nBins] << "\'). return pos " << nBins-1 << ", " << m_bins[nBins-1] << "-" << m_bins[nBins] << std::endl;
+    if(!failBounds) return nBins-1;
+    return -1;
+  }
+  else if(std::isnan(inVal)) return -1;
+
+  if(m_isUniform){
+    int pos = (int)((inVal - m_bins[0])*m_invWidth);
+    if(pos >= nBins) pos = nBins-1;
+    else if(pos < 0) pos = 0;
+
+    while(inVal < m_bins[pos]){--pos;}
+    while(inVal >= m_bins[pos+1]){++pos;}
+    return pos;
+  }
+
+  return (std::upper_bound(m_bins.begin(), m_bins.end(), inVal) - m_bins.begin()) - 1;
+}
+
+//Threshold table lookup, as used for the FCal sum Et -> centrality tables
+//Ascending tables return pos w/ vals[pos] < x <= vals[pos+1], descending vals[pos] > x >= vals[pos+1], else -1
+//A uniform grid over the table range narrows each search to the few entries near x
+class thresholdLookup
+{
+ public:
+  thresholdLookup(){return;}
+  ~thresholdLookup(){};
+
+  bool Init(std::vector<double> inVals, bool inIsDescending, unsigned int inNCells=1024);
+  inline int GetPos(double inVal) const;
+
+ private:
+  inline int SearchRange(double inVal, int inLow, int inHigh) const;
+
+  std::vector<double> m_vals;
+  bool m_isDescending = false;
+  double m_minVal = 0.0;
+  double m_maxVal = 0.0;
+  double m_invCellWidth = 0.0;
+  std::vector<int> m_gridPos;
+};
+
+inline bool thresholdLookup::Init(std::vector<double> inVals, bool inIsDescending, unsigned int inNCells)
+{
+  m_vals = inVals;
+  m_isDescending = inIsDescending;
+  m_gridPos.clear();
+  if(m_vals.size() < 2 || inNCells == 0) return false;
+
+  m_minVal = m_vals[0];
+  m_maxVal = m_vals[m_vals.size()-1];
+  if(m_isDescending) std::swap(m_minVal, m_maxVal);
+  if(m_maxVal <= m_minVal) return false;
+
+  m_invCellWidth = ((double)inNCells)/(m_maxVal - m_minVal);
+
+  //Full-range search result at every grid edge; lower_bound position is monotonic in x, so these bracket any x in a cell
+  for(unsigned int cI = 0; cI < inNCells+1; ++cI){
+    m_gridPos.push_back(SearchRange(m_minVal + ((double)cI)/m_invCellWidth, 0, m_vals.size()));
+  }
+
+  return true;
+}
+
+inline int thresholdLookup::SearchRange(double inVal, int inLow, int inHigh) const
+{
+  if(m_isDescending) return std::lower_bound(m_vals.begin() + inLow, m_vals.begin() + inHigh, inVal, std::greater<double>()) - m_vals.begin();
+  return std::lower_bound(m_vals.begin() + inLow, m_vals.begin() + inHigh, inVal) - m_vals.begin();
+}
+
+inline int thresholdLookup::GetPos(double inVal) const
+{
+  if(m_gridPos.size() == 0) return -1;
+  if(!(inVal >= m_minVal && inVal <= m_maxVal)) return -1;//also catches nan
+
+  const int nCells = m_gridPos.size()-1;
+  int cell = (int)((inVal - m_minVal)*m_invCellWidth);
+  if(cell >= nCells) cell = nCells-1;
+
+  //Widen by one cell each side so rounding in the cell calc can never put x outside the bracket
+  const int cellLow = TMath::Max(0, cell-1);
+  const int cellHigh = TMath::Min(nCells, cell+2);
+  const int searchLow = TMath::Min(m_gridPos[cellLow], m_gridPos[cellHigh]);
+  const int searchHigh = TMath::Max(m_gridPos[cellLow], m_gridPos[cellHigh]);
+
+  const int pos = SearchRange(inVal, searchLow, searchHigh);
+  if(pos == 0 || pos >= (int)m_vals.size()) return -1;
+  return pos-1;
+}
+
+#endif
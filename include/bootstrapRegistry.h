@@ -0,0 +1,109 @@
+#ifndef BOOTSTRAPREGISTRY_H
+#define BOOTSTRAPREGISTRY_H
+
+//c+cpp
+#include <algorithm>
+#include <string>
+#include <vector>
+
+//ROOT
+#include "TDirectory.h"
+
+//Local
+#include "include/counterRNG.h"
+
+//Poisson bootstrap replicas of 1D histograms, filled in the same pass as the nominal ones
+//SetEvent() draws one Poisson(1) weight per replica from a counterRNG stream keyed on (seed, runNumber, eventNumber),
+//so an event gets the same replica weights in every tool and job, independent of file splitting or threads
+//Replica r is always draw r of the stream, so runs w/ different numbers of replicas agree on the replicas they share
+//All observables share one float buffer laid out [observable][bin][replica], so a fill touches nReplicas consecutive floats
+//Written as one TH2F per observable, x the observable and y the replica index; the nominal histogram is not included
+class bootstrapRegistry{
+ public:
+  bootstrapRegistry(){};
+  bootstrapRegistry(unsigned int in_nReplicas, unsigned long long in_seed){Init(in_nReplicas, in_seed);}
+  ~bootstrapRegistry(){};
+
+  bool Init(unsigned int in_nReplicas, unsigned long long in_seed);
+  //in_group is any caller index (e.g. centrality) for Write(); returns the observable id or -1
+  int Book(std::string in_name, std::string in_title, int in_nBins, const double* in_bins, int in_group = -1);
+  int Book(std::string in_name, std::string in_title, int in_nBins, double in_low, double in_high, int in_group = -1);
+  //Copy of the bookings w/ zeroed contents, for worker threads
+  bool CopyBookings(const bootstrapRegistry& in_registry);
+
+  inline void SetEvent(int in_runNumber, int in_eventNumber);
+  //Same convention as fillTH1: weight < 0 fills unweighted
+  inline void Fill(int in_obs, double in_x, double in_weight = -1.0);
+
+  bool Merge(const bootstrapRegistry& in_registry);
+  //Writes the observables booked w/ in_group (all if -1) into in_dir_p in booking order; returns the number written
+  int Write(TDirectory* in_dir_p, int in_group = -1) const;
+
+  inline bool GetDoBootstrap() const {return m_nReplicas > 0;}
+  inline unsigned int GetNReplicas() const {return m_nReplicas;}
+  unsigned long long GetNBytes() const;
+  void Clean();
+
+ private:
+  struct bootstrapRegistryObs{
+    std::string name;
+    std::string title;
+    int group;
+    int nBins;
+    std::vector<double> edges;
+    bool isUniform;
+    double low;
+    double invWidth;
+    unsigned long long offset;//position of (underflow bin, replica 0) in m_vals
+  };
+
+  inline int FindBin(const bootstrapRegistryObs& in_obs, double in_x) const;
+
+  //Poisson(1) cumulative distribution, P(k > 15) is below 1e-13 and folded into the last entry
+  static const int m_nPoissonCDF = 16;
+  double m_poissonCDF[m_nPoissonCDF];
+
+  unsigned int m_nReplicas = 0;
+  unsigned long long m_seed = 0;
+  counterRNG m_rng;
+  std::vector<float> m_weights;
+
+  std::vector<bootstrapRegistryObs> m_obs;
+  std::vector<float> m_vals;
+};
+
+inline void bootstrapRegistry::SetEvent(int in_runNumber, int in_eventNumber)
+{
+  m_rng.SetStream(m_seed ^ (((unsigned long long)((unsigned int)in_runNumber)) << 32), (unsigned int)in_eventNumber);
+  for(unsigned int rI = 0; rI < m_nReplicas; ++rI){
+    const double rndm = m_rng.Rndm();
+    int val = 0;
+    while(val < m_nPoissonCDF-1 && rndm > m_poissonCDF[val]){++val;}
+    m_weights[rI] = val;
+  }
+  return;
+}
+
+//0 is underflow and nBins+1 overflow as in TH1
+inline int bootstrapRegistry::FindBin(const bootstrapRegistryObs& in_obs, double in_x) const
+{
+  if(!(in_x >= in_obs.edges[0])) return 0;
+  if(in_x >= in_obs.edges[in_obs.nBins]) return in_obs.nBins+1;
+  if(in_obs.isUniform){
+    const int binPos = 1 + (int)((in_x - in_obs.low)*in_obs.invWidth);
+    return binPos > in_obs.nBins ? in_obs.nBins : binPos;
+  }
+  return std::upper_bound(in_obs.edges.begin(), in_obs.edges.end(), in_x) - in_obs.edges.begin();
+}
+
+inline void bootstrapRegistry::Fill(int in_obs, double in_x, double in_weight)
+{
+  const bootstrapRegistryObs& obs = m_obs[in_obs];
+  const float weight = in_weight < 0 ? 1.0 : in_weight;
+  float* vals_p = m_vals.data() + obs.offset + ((unsigned long long)FindBin(obs, in_x))*m_nReplicas;
+  const float* weights_p = m_weights.data();
+  for(unsigned int rI = 0; rI < m_nReplicas; ++rI){vals_p[rI] += weight*weights_p[rI];}
+  return;
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef CALIBLOOKUP_H
+#define CALIBLOOKUP_H
+
+//c+cpp
+#include <string>
+#include <vector>
+
+//ROOT
+#include "TF1.h"
+
+//Calibration factor 1/f(x) of a TF1, tabulated on a grid uniform in log(x) and linearly interpolated
+//Grid is refined at Init until the max relative deviation from 1/TF1::Eval is within the given bound
+//Values outside [xLow, xHigh) (or every value if the table is off or could not reach the bound) use TF1::Eval directly
+class calibLookup{
+ public:
+  calibLookup(){};
+  calibLookup(TF1* in_func_p, bool in_doTable, Double_t in_xLow, Double_t in_xHigh, Double_t in_maxRelDev);
+  ~calibLookup();
+
+  bool Init(TF1* in_func_p, bool in_doTable, Double_t in_xLow, Double_t in_xHigh, Double_t in_maxRelDev);
+  float GetFactor(float in_x) const;
+  void GetFactors(const std::vector<float>* in_x_p, std::vector<float>* out_factors_p) const;
+
+  bool GetIsInit() const;
+  bool GetIsTable() const;
+  unsigned int GetNPoints() const;
+  Double_t GetMaxRelDev() const;
+  void Print() const;
+  void Clean();
+
+  //out[i] = in[i]*factors[i], returns false if in is shorter than factors
+  static bool ApplyFactors(const std::vector<float>* in_factors_p, const std::vector<float>* in_vals_p, std::vector<float>* out_vals_p);
+
+ private:
+  Double_t EvalTable(Double_t in_x) const;
+
+  TF1* m_func_p = nullptr;
+  bool m_isInit = false;
+  bool m_isTable = false;
+
+  Double_t m_xLow = 0;
+  Double_t m_xHigh = 0;
+  Double_t m_logXLow = 0;
+  Double_t m_invLogStep = 0;
+  Double_t m_maxRelDev = 0;
+
+  std::vector<float> m_factors;
+
+  const unsigned int m_nMinPoints = 257;
+  const unsigned int m_nMaxPoints = 1048577;
+};
+
+#endif
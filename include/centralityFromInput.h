@@ -7,6 +7,7 @@
 #include <vector>
 
 //Local
+#include "include/binLookup.h"
 #include "include/checkMakeDir.h"
 
 class centralityFromInput
@@ -25,6 +26,7 @@ class centralityFromInput
   bool m_isInit;
   bool m_isDescending;
   std::vector<double> m_centVals;
+  thresholdLookup m_centLookup;
 };
 
 #endif
@@ -0,0 +1,182 @@
+#ifndef COLUMNARCACHE_H
+#define COLUMNARCACHE_H
+
+//c+cpp
+#include <iostream>
+#include <string>
+#include <vector>
+
+//ROOT
+#include "TTree.h"
+
+//Flat, memory-mapped copy of selected branches of a skim tree, for repeated histogramming passes w/o ROOT decompression
+//Layout in the cache directory, one pair of files per branch:
+//  <branch>.col - raw values, entry after entry (bool stored as 1 byte)
+//  <branch>.off - std::vector branches only, nEntries+1 ULong64_t offsets into .col, entry i is [off[i], off[i+1])
+//  columnarCache.txt - manifest w/ nEntries, source files + sizes + mtimes, the requested branch names and the columns; written last, so a partial cache is never picked up
+//Supported: scalar and fixed size array leaves and std::vector of Float_t, Int_t, UInt_t, Bool_t, Double_t, Short_t
+class columnarCache{
+ public:
+  columnarCache(){};
+  ~columnarCache();
+
+  //Branch names may end in '*' to take every branch w/ that prefix; missing or unsupported branches are skipped w/ a warning
+  static bool Write(TTree* in_tree_p, std::vector<std::string> in_branchNames, std::string in_cacheDir, std::vector<std::string> in_sourceFiles);
+
+  //Fails (w/o error, caller falls back to the tree) if there is no complete cache or its sources differ from the given files
+  bool Open(std::string in_cacheDir, std::vector<std::string> in_sourceFiles);
+  bool GetIsOpen() const;
+  bool HasBranch(std::string in_branchName) const;
+  //True if every name (wildcards included, as given to Write()) was requested when the cache was written
+  bool HasRequestedBranches(std::vector<std::string> in_branchNames) const;
+  bool HasMissingBranches() const;
+  Long64_t GetEntries() const;
+
+  template <typename T>
+  bool SetBranchAddress(std::string in_branchName, T* in_addr_p);
+  template <typename T, size_t N>
+  bool SetBranchAddress(std::string in_branchName, T (*in_addr_p)[N]);
+  template <typename T>
+  bool SetBranchAddress(std::string in_branchName, std::vector<T>** in_addr_p);
+
+  Int_t GetEntry(Long64_t in_entry);
+  Double_t GetMinimum(std::string in_branchName) const;
+  Double_t GetMaximum(std::string in_branchName) const;
+  void Close();
+
+  enum columnKind{kScalar = 0, kArray = 1, kVector = 2};
+  enum columnType{kFloat = 0, kInt = 1, kUInt = 2, kBool = 3, kDouble = 4, kUnknown = 5, kShort = 6};
+
+  static unsigned int GetTypeSize(int in_type);
+  static std::string GetManifestName(std::string in_cacheDir);
+
+  //Write() into a fresh directory from MakeTempDir() next to the cache, then Install() renames it into place, so concurrent jobs
+  //never read a cache another job is still writing; an existing cache directory is moved aside and removed
+  static std::string MakeTempDir(std::string in_cacheDir);
+  static bool Install(std::string in_tempDir, std::string in_cacheDir);
+  static void Remove(std::string in_cacheDir);
+
+ private:
+  struct column{
+    std::string name;
+    int kind;
+    int type;
+    unsigned int len;//values per entry for kScalar/kArray
+
+    const char* data_p;
+    size_t dataBytes;
+    const ULong64_t* offsets_p;
+    size_t offsetsBytes;
+  };
+
+  struct binding{
+    unsigned int colPos;
+    void* addr_p;
+  };
+
+  static int GetTypeCode(const Float_t*){return kFloat;}
+  static int GetTypeCode(const Int_t*){return kInt;}
+  static int GetTypeCode(const UInt_t*){return kUInt;}
+  static int GetTypeCode(const Bool_t*){return kBool;}
+  static int GetTypeCode(const Double_t*){return kDouble;}
+  static int GetTypeCode(const Short_t*){return kShort;}
+  template <typename T>
+  static int GetTypeCode(const T*){return kUnknown;}
+
+  int GetColumnPos(std::string in_branchName) const;
+  Double_t GetExtremum(std::string in_branchName, bool in_isMax) const;
+  bool Bind(std::string in_branchName, int in_kind, int in_type, unsigned int in_len, void* in_addr_p);
+  template <typename T>
+  void FillVector(const column* in_col_p, Long64_t in_entry, void* in_addr_p);
+  bool MapFile(std::string in_fileName, const char** out_data_p, size_t* out_bytes_p);
+  void UnmapAll();
+  void DeleteOwned();
+
+  bool m_isOpen = false;
+  bool m_hasMissing = false;
+  std::string m_cacheDir = "";
+  Long64_t m_nEntries = 0;
+
+  std::vector<column> m_columns;
+  std::vector<binding> m_bindings;
+  std::vector<std::string> m_requested;
+
+  //Vectors the cache allocated for null branch pointers; callers keep pointing at them, so they live until the cache is destroyed, not just closed
+  std::vector<std::vector<Float_t>*> m_ownedFloat;
+  std::vector<std::vector<Int_t>*> m_ownedInt;
+  std::vector<std::vector<UInt_t>*> m_ownedUInt;
+  std::vector<std::vector<bool>*> m_ownedBool;
+  std::vector<std::vector<Double_t>*> m_ownedDouble;
+  std::vector<std::vector<Short_t>*> m_ownedShort;
+
+  std::vector<std::pair<const char*, size_t> > m_maps;
+};
+
+template <typename T>
+bool columnarCache::SetBranchAddress(std::string in_branchName, T* in_addr_p)
+{
+  return Bind(in_branchName, kScalar, GetTypeCode(in_addr_p), 1, (void*)in_addr_p);
+}
+
+template <typename T, size_t N>
+bool columnarCache::SetBranchAddress(std::string in_branchName, T (*in_addr_p)[N])
+{
+  return Bind(in_branchName, kArray, GetTypeCode((T*)in_addr_p), N, (void*)in_addr_p);
+}
+
+template <typename T>
+bool columnarCache::SetBranchAddress(std::string in_branchName, std::vector<T>** in_addr_p)
+{
+  const int typeCode = GetTypeCode((T*)nullptr);
+  if(!Bind(in_branchName, kVector, typeCode, 0, (void*)in_addr_p)) return false;
+
+  if(*in_addr_p == nullptr){
+    *in_addr_p = new std::vector<T>;
+    if(typeCode == kFloat) m_ownedFloat.push_back((std::vector<Float_t>*)(*in_addr_p));
+    else if(typeCode == kInt) m_ownedInt.push_back((std::vector<Int_t>*)(*in_addr_p));
+    else if(typeCode == kUInt) m_ownedUInt.push_back((std::vector<UInt_t>*)(*in_addr_p));
+    else if(typeCode == kBool) m_ownedBool.push_back((std::vector<bool>*)(*in_addr_p));
+    else if(typeCode == kDouble) m_ownedDouble.push_back((std::vector<Double_t>*)(*in_addr_p));
+    else if(typeCode == kShort) m_ownedShort.push_back((std::vector<Short_t>*)(*in_addr_p));
+  }
+
+  return true;
+}
+
+template <typename T>
+void columnarCache::FillVector(const column* in_col_p, Long64_t in_entry, void* in_addr_p)
+{
+  std::vector<T>* vect_p = *((std::vector<T>**)in_addr_p);
+  const ULong64_t low = in_col_p->offsets_p[in_entry];
+  const ULong64_t high = in_col_p->offsets_p[in_entry+1];
+  const T* vals_p = ((const T*)in_col_p->data_p) + low;
+  vect_p->assign(vals_p, vals_p + (high - low));
+  return;
+}
+
+//Forwards to the cache when one is open, else to the tree, so a tool keeps one set of branch setup calls for both
+class columnarTreeReader{
+ public:
+  columnarTreeReader(TTree* in_tree_p, columnarCache* in_cache_p){m_tree_p = in_tree_p; m_cache_p = in_cache_p;}
+  ~columnarTreeReader(){};
+
+  bool GetUseCache() const {return m_cache_p != nullptr && m_cache_p->GetIsOpen();}
+  void SetBranchStatus(std::string in_branchName, Bool_t in_status){if(!GetUseCache()) m_tree_p->SetBranchStatus(in_branchName.c_str(), in_status); return;}
+  template <typename T>
+  void SetBranchAddress(std::string in_branchName, T* in_addr_p)
+  {
+    if(GetUseCache()) m_cache_p->SetBranchAddress(in_branchName, in_addr_p);
+    else m_tree_p->SetBranchAddress(in_branchName.c_str(), in_addr_p);
+    return;
+  }
+  Int_t GetEntry(Long64_t in_entry){return GetUseCache() ? m_cache_p->GetEntry(in_entry) : m_tree_p->GetEntry(in_entry);}
+  Long64_t GetEntries() const {return GetUseCache() ? m_cache_p->GetEntries() : m_tree_p->GetEntries();}
+  Double_t GetMinimum(std::string in_branchName){return GetUseCache() ? m_cache_p->GetMinimum(in_branchName) : m_tree_p->GetMinimum(in_branchName.c_str());}
+  Double_t GetMaximum(std::string in_branchName){return GetUseCache() ? m_cache_p->GetMaximum(in_branchName) : m_tree_p->GetMaximum(in_branchName.c_str());}
+
+ private:
+  TTree* m_tree_p = nullptr;
+  columnarCache* m_cache_p = nullptr;
+};
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef COUNTERRNG_H
+#define COUNTERRNG_H
+
+//c+cpp
+#include <cmath>
+
+//Counter-based random stream: draw n of stream (seed, streamID) is a pure function of (seed, streamID, n)
+//Give each event its own stream (e.g. streamID = event index) and the output no longer depends on how events are split over threads
+//Bits come from the SplitMix64 finalizer applied to key + n*golden ratio, no state beyond the counter
+class counterRNG{
+ public:
+  counterRNG(){};
+  counterRNG(unsigned long long in_seed, unsigned long long in_streamID){SetStream(in_seed, in_streamID);}
+  ~counterRNG(){};
+
+  inline void SetStream(unsigned long long in_seed, unsigned long long in_streamID);
+  inline unsigned long long GetCounter() const {return m_counter;}
+
+  inline unsigned long long RndmBits();
+  inline double Rndm();//(0, 1)
+  inline double Uniform(double in_low, double in_high);
+  inline double Gaus(double in_mean = 0.0, double in_sigma = 1.0);
+  inline unsigned long long Poisson(double in_mean);
+
+ private:
+  static inline unsigned long long Mix(unsigned long long in_val);
+
+  static const unsigned long long m_golden = 0x9E3779B97F4A7C15ULL;
+  unsigned long long m_key = 0;
+  unsigned long long m_counter = 0;
+};
+
+inline unsigned long long counterRNG::Mix(unsigned long long in_val)
+{
+  in_val = (in_val ^ (in_val >> 30))*0xBF58476D1CE4E5B9ULL;
+  in_val = (in_val ^ (in_val >> 27))*0x94D049BB133111EBULL;
+  return in_val ^ (in_val >> 31);
+}
+
+inline void counterRNG::SetStream(unsigned long long in_seed, unsigned long long in_streamID)
+{
+  m_key = Mix(Mix(in_seed + m_golden) ^ (in_streamID*m_golden + 1));
+  m_counter = 0;
+  return;
+}
+
+inline unsigned long long counterRNG::RndmBits()
+{
+  ++m_counter;
+  return Mix(m_key + m_counter*m_golden);
+}
+
+//Top 53 bits, shifted by half a step so neither 0 nor 1 is returned
+inline double counterRNG::Rndm(){return ((double)(RndmBits() >> 11) + 0.5)*(1.0/9007199254740992.0);}
+
+inline double counterRNG::Uniform(double in_low, double in_high){return in_low + (in_high - in_low)*Rndm();}
+
+//Box-Muller w/o a cached second value, so every call uses exactly two draws
+inline double counterRNG::Gaus(double in_mean, double in_sigma)
+{
+  const double u1 = Rndm();
+  const double u2 = Rndm();
+  return in_mean + in_sigma*std::sqrt(-2.0*std::log(u1))*std::cos(2.0*M_PI*u2);
+}
+
+//Product of uniforms below a mean of 88, rounded Gaussian approximation above it as TRandom::Poisson does
+inline unsigned long long counterRNG::Poisson(double in_mean)
+{
+  if(in_mean <= 0) return 0;
+
+  if(in_mean < 88){
+    const double expMean = std::exp(-in_mean);
+    unsigned long long nVal = 0;
+    double prod = Rndm();
+    while(prod > expMean){
+      prod *= Rndm();
+      ++nVal;
+    }
+    return nVal;
+  }
+
+  const double val = Gaus(in_mean, std::sqrt(in_mean)) + 0.5;
+  return val < 0 ? 0 : (unsigned long long)val;
+}
+
+#endif
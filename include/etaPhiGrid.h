@@ -0,0 +1,46 @@
+#ifndef ETAPHIGRID_H
+#define ETAPHIGRID_H
+
+//c+cpp
+#include <vector>
+
+//Cell list over (eta, phi) for fixed radius neighbor queries, filled once per event
+//Cells are at least maxR wide so any entry w/in maxR of a point is in the 3x3 block around it; phi wraps around
+//Entries beyond +-etaMax go to the edge cells, non-finite eta/phi are dropped (they never pass a dR cut)
+//Queries return a superset of the matches; the exact dR cut stays with the caller so values are unchanged
+class etaPhiGrid{
+ public:
+  etaPhiGrid(){};
+  etaPhiGrid(double in_maxR, double in_etaMax);
+  ~etaPhiGrid();
+
+  bool Init(double in_maxR, double in_etaMax);
+  void Clear();
+  void Add(unsigned int in_index, float in_eta, float in_phi);
+  void Build();
+  void GetCandidates(float in_eta, float in_phi, std::vector<unsigned int>* out_indices_p) const;
+
+  bool GetIsInit() const;
+  unsigned int GetNCells() const;
+  unsigned int GetNEntries() const;
+  void Clean();
+
+ private:
+  int GetEtaCell(float in_eta) const;
+  int GetPhiCell(float in_phi) const;
+
+  bool m_isInit = false;
+  double m_etaMax = 0;
+  int m_nEtaCells = 0;
+  int m_nPhiCells = 0;
+  double m_invEtaWidth = 0;
+  double m_invPhiWidth = 0;
+
+  std::vector<unsigned int> m_addIndices;
+  std::vector<unsigned int> m_addCells;
+
+  std::vector<unsigned int> m_cellOffsets;//size nCells+1, cell c is [offsets[c], offsets[c+1]) in m_cellIndices
+  std::vector<unsigned int> m_cellIndices;//ordered by cell, then by Add() order
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef EVENTINDEX_H
+#define EVENTINDEX_H
+
+//c+cpp
+#include <string>
+#include <vector>
+
+//ROOT
+#include "TTree.h"
+
+//Local
+#include "include/centralityFromInput.h"
+
+//Loose per-event preselection on the eventIndex summary; every cut is a superset of the matching event loop cut
+struct eventIndexSelection{
+  double vzLow = -1.0e30;//raw vert_z[0] as in the skim, kept if vzLow < vz < vzHigh
+  double vzHigh = 1.0e30;
+  bool doCent = false;//centrality from the tool's own table on fcalA_et + fcalC_et, kept if centLow <= cent <= centHigh
+  double centLow = 0.0;
+  double centHigh = 100.0;
+  double photonPtMin = -1.0;//maxPhotonPt >= photonPtMin
+  unsigned char photonIDMask = 0;//any of these bits set, 0 for no ID requirement
+  bool keepTruthPhoton = false;//MC, also keep the event if truthPhotonPt >= photonPtMin
+};
+
+//Compact per-entry summary of the preProc skim, written as eventIndexTree_p next to gammaJetTree_p, entry for entry
+//Histogramming tools read only the summary, keep the skim entries passing a loose preselection and GetEntry() just those
+//maxPhotonPt is over the nominal and, in MC, the photon energy variation pts, so the index holds for a SYSSWEEP too
+class eventIndex{
+ public:
+  enum photonIDBits{kPhotonTight = 1, kPhotonNonTight = 2, kPhotonNonLoose = 4};
+
+  eventIndex(){};
+  ~eventIndex(){};
+
+  //Write side, gdjNtuplePreProc_phoTaggedJetRaa
+  void Branch(TTree* in_tree_p);
+  void SetEvent(float in_vz, float in_fcalEt, float in_truthPhotonPt);
+  void AddPhotons(const std::vector<float>* in_pt_p, const std::vector<bool>* in_tight_p, const std::vector<bool>* in_loose_p);
+  //pt only, for energy variations of the same photons
+  void AddPhotonPts(const std::vector<float>* in_pt_p);
+
+  //Read side; false (w/ a warning) if any file has no index or the index and skim entries differ, then GetEntry() is the identity
+  bool Init(std::vector<std::string> in_fileNames, Long64_t in_nTreeEntries, eventIndexSelection in_sel, centralityFromInput* in_centTable_p = nullptr);
+  void SelectAll(Long64_t in_nTreeEntries);
+  //Keeps only tree entries below in_nMaxTreeEntries, so an entry cap (e.g. NEVT) means the same skim range w/ and w/o preselection
+  void CapTreeEntries(Long64_t in_nMaxTreeEntries);
+  bool GetDoSelect() const {return m_doSelect;}
+  Long64_t GetNEntries() const {return m_doSelect ? (Long64_t)m_entries.size() : m_nTreeEntries;}
+  Long64_t GetEntry(Long64_t in_pos) const {return m_doSelect ? m_entries[in_pos] : in_pos;}
+  void Clean();
+
+  static std::string GetTreeName(){return "eventIndexTree_p";}
+
+ private:
+  Float_t m_vz = 0.0;
+  Float_t m_fcalEt = 0.0;
+  Float_t m_truthPhotonPt = -999.;
+  Float_t m_maxPhotonPt = -999.;
+  UChar_t m_photonIDMask = 0;
+
+  bool m_doSelect = false;
+  Long64_t m_nTreeEntries = 0;
+  std::vector<Long64_t> m_entries;
+};
+
+#endif
@@ -5,7 +5,7 @@
 #include <iostream>
 #include <vector>
 
-inline int ghostPos(std::vector<float> bins_, double ghostVal, bool failBounds=true, bool printWarnings=false)
+inline int ghostPos(const std::vector<float>& bins_, double ghostVal, bool failBounds=true, bool printWarnings=false)
 {
   if(bins_.size() == 0){
     std::cout << "MAKECLUSTERTREE GHOSTPOS ERROR: Given bins have size \'0\'. returning int32 max for absurd result" << std::endl;
@@ -32,17 +32,37 @@ inline int ghostPos(std::vector<float> bins_, double ghostVal, bool failBounds=t
   return ghostPos;
 }
 
+//Same float compare as the vector<float> version, w/o building a vector on every call
+//For repeated lookups on fixed bins see binLookup in include/binLookup.h
 inline int ghostPos(Int_t nBins, Double_t bins[], double ghostVal, bool failBounds=true, bool printWarnings=false)
 {
-  std::vector<float> binsVect;
-  for(Int_t bI = 0; bI < nBins+1; ++bI){
-    binsVect.push_back(bins[bI]);
+  if(nBins+1 <= 0){
+    std::cout << "MAKECLUSTERTREE GHOSTPOS ERROR: Given bins have size \'0\'. returning int32 max for absurd result" << std::endl;
+    return 2147483647;//lol
+  }
+
+  int ghostPos = -1;
+  if(ghostVal<(float)bins[0]){
+    if(printWarnings) std::cout << "WARNING MAKECLUSTERTREE GHOSTPOS: Given value \'" << ghostVal << "\' falls below binning (low edge \'" << (float)bins[0] << "\'). return pos 0" << std::endl;
+    if(!failBounds) ghostPos = 0;
+  }
+  else if(ghostVal>=(float)bins[nBins]){
+    if(!failBounds) ghostPos = nBins-1;
+    if(printWarnings) std::cout << "WARNING MAKECLUSTERTREE GHOSTPOS: Given value \'" << ghostVal << "\' is above binning (high edge \'" << (float)bins[nBins] << "\'). return pos " << nBins-1 << ", " << (float)bins[nBins-1] << "-" << (float)bins[nBins] << std::endl;
   }
-  return ghostPos(binsVect, ghostVal, failBounds, printWarnings);
+  else{
+    for(Int_t ie = 0; ie < nBins; ++ie){
+      if(ghostVal>=(float)bins[ie] && ghostVal<(float)bins[ie+1]){
+        ghostPos = ie;
+        break;
+      }
+    }
+  }
+  return ghostPos;
 }
 
 
-inline int ghostPos(std::vector<int> bins_, double ghostVal, bool failBounds=true, bool printWarnings=false)
+inline int ghostPos(const std::vector<int>& bins_, double ghostVal, bool failBounds=true, bool printWarnings=false)
 {
   if(bins_.size() == 0){
     std::cout << "MAKECLUSTERTREE GHOSTPOS ERROR: Given bins have size \'0\'. returning int32 max for absurd result" << std::endl;
@@ -13,10 +13,18 @@ class globalDebugHandler
   ~globalDebugHandler(){};
 
   bool GetDoGlobalDebug();
+  //Optional, DOGLOBALTIMINGROOT=1 turns on the stageTimer summary; unset is off
+  bool GetDoGlobalTiming();
+  //Optional, GLOBALTIMINGJSON=<file> also writes the stageTimer summary as json
+  std::string GetGlobalTimingJSON();
 
  private:
   const std::string envVarStr = "DOGLOBALDEBUGROOT";
+  const std::string timingEnvVarStr = "DOGLOBALTIMINGROOT";
+  const std::string timingJSONEnvVarStr = "GLOBALTIMINGJSON";
   bool m_doGlobalDebug;
+  bool m_doGlobalTiming;
+  std::string m_globalTimingJSON;
 };
 
 #endif
@@ -0,0 +1,81 @@
+#ifndef GOODRUNLIST_H
+#define GOODRUNLIST_H
+
+//c+cpp
+#include <string>
+#include <utility>
+#include <vector>
+
+//Good run list parsed once from the GRL xml (input/data*.xml), w/ a dense lumiblock bitmap per run
+//Runs are found through a flat table over [minRun, maxRun], so IsGood() and MarkSeen() are a couple of array reads per event
+//Seen lumiblocks feed the per-run lumi fraction; as before, seen lumiblocks outside the GRL ranges of a listed run count too
+//For threaded event loops give each worker a copy and MergeSeen() the copies after
+class goodRunList{
+ public:
+  goodRunList(){};
+  goodRunList(std::string in_grlFileName);
+  ~goodRunList();
+
+  bool Init(std::string in_grlFileName);
+  inline bool IsGood(int in_run, unsigned int in_lb) const;
+  inline void MarkSeen(int in_run, unsigned int in_lb);
+  void MergeSeen(const goodRunList& in_grl);
+  void ClearSeen();
+
+  bool GetIsInit() const;
+  std::vector<int> GetRuns() const;//ascending
+  std::vector<std::pair<unsigned int, unsigned int> > GetLBRanges(int in_run) const;//inclusive, in file order
+  unsigned int GetNGood(int in_run) const;
+  unsigned int GetNSeen(int in_run) const;
+  double GetLumiFraction(int in_run) const;
+  void Clean();
+
+ private:
+  struct runLumiBits{
+    int run;
+    unsigned int nGood;
+    std::vector<std::pair<unsigned int, unsigned int> > lbRanges;
+    std::vector<unsigned long long> good;
+    std::vector<unsigned long long> seen;
+  };
+
+  inline int GetRunPos(int in_run) const;
+  static unsigned int CountBits(const std::vector<unsigned long long>& in_bits);
+
+  bool m_isInit = false;
+  int m_minRun = 0;
+  std::vector<int> m_runPos;//run - minRun -> position in m_runs, -1 if not in the GRL
+  std::vector<runLumiBits> m_runs;//ascending in run
+};
+
+inline int goodRunList::GetRunPos(int in_run) const
+{
+  const unsigned int runOffset = (unsigned int)(in_run - m_minRun);
+  if(runOffset >= m_runPos.size()) return -1;
+  return m_runPos[runOffset];
+}
+
+inline bool goodRunList::IsGood(int in_run, unsigned int in_lb) const
+{
+  const int runPos = GetRunPos(in_run);
+  if(runPos < 0) return false;
+
+  const std::vector<unsigned long long>& good = m_runs[runPos].good;
+  const unsigned int word = in_lb/64;
+  if(word >= good.size()) return false;
+  return (good[word] >> (in_lb%64)) & 1ULL;
+}
+
+inline void goodRunList::MarkSeen(int in_run, unsigned int in_lb)
+{
+  const int runPos = GetRunPos(in_run);
+  if(runPos < 0) return;
+
+  std::vector<unsigned long long>& seen = m_runs[runPos].seen;
+  const unsigned int word = in_lb/64;
+  if(word >= seen.size()) seen.resize(word+1, 0ULL);
+  seen[word] |= 1ULL << (in_lb%64);
+  return;
+}
+
+#endif
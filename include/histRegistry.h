@@ -0,0 +1,115 @@
+#ifndef HISTREGISTRY_H
+#define HISTREGISTRY_H
+
+//c+cpp
+#include <string>
+#include <vector>
+
+//ROOT
+#include "TDirectory.h"
+#include "TH1.h"
+#include "TH2.h"
+
+//One axis of a booked histogram; edges empty means uniform bins in [low, high)
+struct histRegistryAxis{
+  histRegistryAxis(){};
+  histRegistryAxis(int in_nBins, double in_low, double in_high){nBins = in_nBins; low = in_low; high = in_high;}
+  histRegistryAxis(int in_nBins, const double* in_bins){nBins = in_nBins; low = in_bins[0]; high = in_bins[in_nBins]; edges.assign(in_bins, in_bins + in_nBins + 1);}
+
+  int nBins = 0;
+  double low = 0.0;
+  double high = 0.0;
+  std::vector<double> edges;
+};
+
+//Histograms booked per observable over a (cent, pt, eta) grid of positions, allocated on first fill
+//The third axis is any second binning (e.g. reco pt next to gen pt); an axis w/ no labels has the single position 0
+//Histograms are built detached from any directory, so booking and filling never touch gDirectory and are safe in worker threads
+//For threaded event loops give each worker a CopyBookings() of the master and Merge() them after, in worker order
+//Used for the MC families of gdjNTupleToHist and the (cent, eta, pt) families of phoTaggedJetRaa_jetPt and phoTaggedJetRaa_photonPurity
+//gdjNTupleToHist's reco/mixed/subtracted (cent, pt) arrays are built from each other after the loop and stay booked up front
+class histRegistry{
+ public:
+  histRegistry(){};
+  ~histRegistry();
+
+  //Names are in_name + "_" + label per axis w/ labels + in_nameSuffix; returns the observable id or -1
+  //Histograms are TH1F/TH2F, or TH1D/TH2D if in_doDouble
+  int Book(std::string in_name, std::string in_title, std::vector<std::string> in_centStrs, std::vector<std::string> in_ptStrs, std::vector<std::string> in_etaStrs, std::string in_nameSuffix, histRegistryAxis in_xAxis, histRegistryAxis in_yAxis = histRegistryAxis(), bool in_doSumw2 = false, bool in_doDouble = false);
+  bool CopyBookings(const histRegistry& in_registry);
+
+  //Same convention as fillTH1/fillTH2: weight < 0 fills unweighted, else Sumw2 is switched on before the weighted fill
+  inline void FillTH1(int in_obs, unsigned int in_centPos, unsigned int in_ptPos, unsigned int in_etaPos, float in_x, float in_weight = -1.0);
+  inline void FillTH2(int in_obs, unsigned int in_centPos, unsigned int in_ptPos, unsigned int in_etaPos, float in_x, float in_y, float in_weight = -1.0);
+  inline TH1* GetHist(int in_obs, unsigned int in_centPos, unsigned int in_ptPos, unsigned int in_etaPos);
+
+  void Merge(histRegistry* in_registry_p);
+  //Writes the booked histograms at in_centPos (all if -1) into in_dir_p in booking order; never filled ones are skipped if in_skipEmpty, else written empty
+  int Write(TDirectory* in_dir_p, int in_centPos = -1, bool in_skipEmpty = false);
+
+  unsigned long long GetNBooked() const;
+  unsigned long long GetNAllocated() const;
+  void Clean();
+
+ private:
+  struct histRegistryObs{
+    std::string name;
+    std::string title;
+    std::vector<std::string> centStrs;
+    std::vector<std::string> ptStrs;
+    std::vector<std::string> etaStrs;
+    std::string nameSuffix;
+    histRegistryAxis xAxis;
+    histRegistryAxis yAxis;
+    bool doSumw2;
+    bool doDouble;
+
+    unsigned int nCent;
+    unsigned int nPt;
+    unsigned int nEta;
+    unsigned long long offset;//position of (0, 0, 0) in m_hists
+  };
+
+  inline unsigned long long GetPos(int in_obs, unsigned int in_centPos, unsigned int in_ptPos, unsigned int in_etaPos) const;
+  TH1* Allocate(int in_obs, unsigned int in_centPos, unsigned int in_ptPos, unsigned int in_etaPos);
+
+  std::vector<histRegistryObs> m_obs;
+  std::vector<TH1*> m_hists;//nullptr until first fill
+};
+
+inline unsigned long long histRegistry::GetPos(int in_obs, unsigned int in_centPos, unsigned int in_ptPos, unsigned int in_etaPos) const
+{
+  const histRegistryObs& obs = m_obs[in_obs];
+  return obs.offset + (((unsigned long long)in_centPos)*obs.nPt + in_ptPos)*obs.nEta + in_etaPos;
+}
+
+inline TH1* histRegistry::GetHist(int in_obs, unsigned int in_centPos, unsigned int in_ptPos, unsigned int in_etaPos)
+{
+  TH1* hist_p = m_hists[GetPos(in_obs, in_centPos, in_ptPos, in_etaPos)];
+  if(hist_p == nullptr) hist_p = Allocate(in_obs, in_centPos, in_ptPos, in_etaPos);
+  return hist_p;
+}
+
+inline void histRegistry::FillTH1(int in_obs, unsigned int in_centPos, unsigned int in_ptPos, unsigned int in_etaPos, float in_x, float in_weight)
+{
+  TH1* hist_p = GetHist(in_obs, in_centPos, in_ptPos, in_etaPos);
+  if(in_weight < 0) hist_p->Fill(in_x);
+  else{
+    if(hist_p->GetSumw2()->fN == 0) hist_p->Sumw2();
+    hist_p->Fill(in_x, in_weight);
+  }
+  return;
+}
+
+inline void histRegistry::FillTH2(int in_obs, unsigned int in_centPos, unsigned int in_ptPos, unsigned int in_etaPos, float in_x, float in_y, float in_weight)
+{
+  TH2* hist_p = static_cast<TH2*>(GetHist(in_obs, in_centPos, in_ptPos, in_etaPos));
+  if(in_weight < 0) hist_p->Fill(in_x, in_y);
+  else{
+    if(hist_p->GetSumw2()->fN == 0) hist_p->Sumw2();
+    hist_p->Fill(in_x, in_y, in_weight);
+  }
+  return;
+}
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef HISTTHREADUTILITY_H
+#define HISTTHREADUTILITY_H
+
+//cpp
+#include <vector>
+
+//ROOT
+#include "TCollection.h"
+#include "TH1.h"
+#include "TList.h"
+
+//Per-thread histogram sets for multithreaded event loops
+//Master histograms are tagged w/ uniqueID = position+1; each worker thread points its thread-local list at a set of clones
+//fill helpers call getThreadHist() so the same histogram pointer can be used in serial and threaded loops
+//uniqueID 0 (default, or no thread list set) means fill the master histogram directly
+
+inline std::vector<TH1*>*& threadHistList()
+{
+  static thread_local std::vector<TH1*>* threadHists_p = nullptr;
+  return threadHists_p;
+}
+
+inline void setThreadHists(std::vector<TH1*>* inHists_p){threadHistList() = inHists_p; return;}
+
+template <typename T>
+inline T* getThreadHist(T* inHist_p)
+{
+  std::vector<TH1*>* threadHists_p = threadHistList();
+  if(threadHists_p == nullptr) return inHist_p;
+
+  const unsigned int histID = inHist_p->GetUniqueID();
+  if(histID == 0 || histID > threadHists_p->size()) return inHist_p;
+
+  return static_cast<T*>((*threadHists_p)[histID-1]);
+}
+
+//Tag every histogram in the given directory list, return them in tag order
+inline std::vector<TH1*> registerThreadHists(TList* inList_p)
+{
+  std::vector<TH1*> masterHists;
+
+  TIter next(inList_p);
+  while(TObject* obj_p = next()){
+    if(!obj_p->InheritsFrom(TH1::Class())) continue;
+
+    masterHists.push_back((TH1*)obj_p);
+    masterHists[masterHists.size()-1]->SetUniqueID(masterHists.size());
+  }
+
+  return masterHists;
+}
+
+//Clone the full set for one worker; clones are detached from any directory
+inline std::vector<TH1*> cloneThreadHists(std::vector<TH1*> masterHists)
+{
+  const Bool_t addDirStatus = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+
+  std::vector<TH1*> cloneHists;
+  for(unsigned int hI = 0; hI < masterHists.size(); ++hI){
+    cloneHists.push_back((TH1*)masterHists[hI]->Clone());
+    cloneHists[hI]->SetDirectory(nullptr);
+  }
+
+  TH1::AddDirectory(addDirStatus);
+  return cloneHists;
+}
+
+//Add worker clones back into the masters and delete them; call in worker order for reproducible output
+//Float bins are order-sensitive: contiguous entry blocks merged in worker order repeat run to run for a given thread count, not across thread counts
+inline void mergeThreadHists(std::vector<TH1*> masterHists, std::vector<TH1*>* cloneHists_p)
+{
+  for(unsigned int hI = 0; hI < masterHists.size(); ++hI){
+    masterHists[hI]->Add((*cloneHists_p)[hI]);
+    delete (*cloneHists_p)[hI];
+  }
+  cloneHists_p->clear();
+
+  return;
+}
+
+//Reset the tags so nothing but the default uniqueID is written out
+inline void unregisterThreadHists(std::vector<TH1*> masterHists)
+{
+  for(unsigned int hI = 0; hI < masterHists.size(); ++hI){
+    masterHists[hI]->SetUniqueID(0);
+  }
+
+  return;
+}
+
+#endif
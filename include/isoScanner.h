@@ -0,0 +1,69 @@
+#ifndef ISOSCANNER_H
+#define ISOSCANNER_H
+
+//c+cpp
+#include <vector>
+
+//ABCD sideband yields for any isolation cut/gap from one event loop
+//Each (cent, eta, pt) bin keeps the corrected isolation and weight of its tight and non-tight photons
+//Finalize() sorts them and builds prefix sums of w and w^2, so every yield is two binary searches
+//Regions follow phoTaggedJetRaa_photonPurity: A/B tight w/ iso < cut / iso > cut + gap, C/D the same for non-tight
+class isoScanner{
+ public:
+  enum isoRegion{A = 0, B = 1, C = 2, D = 3};
+
+  isoScanner(){};
+  isoScanner(unsigned int in_nCent, unsigned int in_nEta, unsigned int in_nPt);
+  ~isoScanner();
+
+  bool Init(unsigned int in_nCent, unsigned int in_nEta, unsigned int in_nPt);
+  //Weight < 0 is taken as unweighted, same as fillTH1
+  inline void Fill(unsigned int in_centPos, unsigned int in_etaPos, unsigned int in_ptPos, bool in_isTight, float in_iso, float in_weight = -1.0);
+  void Finalize();
+
+  //Cuts are float so that the comparisons are the same as the ones in the event loop
+  double GetYield(unsigned int in_centPos, unsigned int in_etaPos, unsigned int in_ptPos, isoRegion in_region, float in_isoCut, float in_isoGap, double* out_sumW2 = nullptr) const;
+  unsigned long long GetCount(unsigned int in_centPos, unsigned int in_etaPos, unsigned int in_ptPos, isoRegion in_region, float in_isoCut, float in_isoGap) const;
+  //1 - (B*C)/(A*D); error from the w^2 sums of the four regions, uncorrelated. Returns 0 if any region is empty
+  double GetPurity(unsigned int in_centPos, unsigned int in_etaPos, unsigned int in_ptPos, float in_isoCut, float in_isoGap, double* out_err = nullptr) const;
+
+  bool GetIsInit() const;
+  bool GetIsFinal() const;
+  unsigned long long GetNPhotons() const;
+  void Clean();
+
+ private:
+  struct isoPopulation{
+    std::vector<float> iso;
+    std::vector<float> weight;
+    std::vector<double> sumW;//sumW[i] = sum of weight[0, i), so size iso.size()+1
+    std::vector<double> sumW2;
+  };
+
+  inline unsigned int GetPos(unsigned int in_centPos, unsigned int in_etaPos, unsigned int in_ptPos, bool in_isTight) const;
+  //Index range [out_low, out_high) of the population falling in the region
+  void GetRange(const isoPopulation& in_pop, isoRegion in_region, float in_isoCut, float in_isoGap, unsigned long long* out_low, unsigned long long* out_high) const;
+
+  bool m_isInit = false;
+  bool m_isFinal = false;
+  unsigned int m_nCent = 0;
+  unsigned int m_nEta = 0;
+  unsigned int m_nPt = 0;
+  std::vector<isoPopulation> m_pops;//tight at even, non-tight at odd positions
+};
+
+inline unsigned int isoScanner::GetPos(unsigned int in_centPos, unsigned int in_etaPos, unsigned int in_ptPos, bool in_isTight) const
+{
+  return 2*((in_centPos*m_nEta + in_etaPos)*m_nPt + in_ptPos) + !in_isTight;
+}
+
+inline void isoScanner::Fill(unsigned int in_centPos, unsigned int in_etaPos, unsigned int in_ptPos, bool in_isTight, float in_iso, float in_weight)
+{
+  isoPopulation& pop = m_pops[GetPos(in_centPos, in_etaPos, in_ptPos, in_isTight)];
+  pop.iso.push_back(in_iso);
+  pop.weight.push_back(in_weight < 0 ? 1.0 : in_weight);
+  m_isFinal = false;
+  return;
+}
+
+#endif
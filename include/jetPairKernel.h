@@ -0,0 +1,42 @@
+#ifndef JETPAIRKERNEL_H
+#define JETPAIRKERNEL_H
+
+//c+cpp
+#include <vector>
+
+//Structure-of-arrays jet buffer for pair observables; Clear() keeps capacity so one buffer per thread is reused for every photon
+//px/py are double, computed as in TLorentzVector::SetPtEtaPhiM(pt, eta, phi, 0), so pair values match the four-vector sum
+struct jetPairBuffer{
+  std::vector<float> pt;
+  std::vector<float> phi;
+  std::vector<double> px;
+  std::vector<double> py;
+  std::vector<int> tPos;//truth match position, -1 if none
+
+  void Clear();
+  void Reserve(unsigned int in_nJets);
+  void Add(float in_pt, float in_phi, int in_tPos = -1);
+  unsigned int size() const {return pt.size();}
+};
+
+//Per-pair output, pair k is the k-th (i, j) in loop order of the ComputePairs call
+struct jetPairValues{
+  std::vector<float> xJJ;//|p_T,i + p_T,j|/p_T,gamma
+  std::vector<float> dPhiJJ;//|dphi(i, j)|, same wrap as getDPHI()
+  std::vector<unsigned char> isMatched;//both jets have tPos >= 0
+
+  unsigned int size() const {return xJJ.size();}
+};
+
+//All i<j pairs of one buffer, or all (i, j) pairs across two buffers, in one pass w/ plain arrays so the inner loop vectorizes
+//Outputs are resized, not appended; pass separate jetPairValues to keep several results
+class jetPairKernel{
+ public:
+  static void ComputePairs(const jetPairBuffer* in_jets_p, float in_photonPt, jetPairValues* out_values_p);
+  static void ComputePairs(const jetPairBuffer* in_jets1_p, const jetPairBuffer* in_jets2_p, float in_photonPt, jetPairValues* out_values_p);
+
+ private:
+  static void ComputeRow(double in_px, double in_py, float in_phi, int in_tPos, const jetPairBuffer* in_jets_p, unsigned int in_start, double in_photonPt, float* out_xJJ, float* out_dPhiJJ, unsigned char* out_isMatched);
+};
+
+#endif
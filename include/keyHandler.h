@@ -20,6 +20,8 @@ class keyHandler{
 
   unsigned long long GetKey(std::vector<unsigned long long> in_vals);
   std::vector<unsigned long long> InvertKey(unsigned long long);
+  unsigned long long GetDenseIndex(std::vector<unsigned long long> in_vals);
+  unsigned long long GetNDenseIndex();
   void Clean();
   
  private:
@@ -27,6 +29,7 @@ class keyHandler{
   bool m_doDebug;
   std::vector<unsigned long long> m_valMaxes;
   std::vector<unsigned long long> m_multipliers;
+  std::vector<unsigned long long> m_denseMultipliers;
 
   unsigned long long GetNearestTen(unsigned long long inVal);
 };
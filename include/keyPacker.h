@@ -0,0 +1,160 @@
+#ifndef KEYPACKER_H
+#define KEYPACKER_H
+
+//c+cpp
+#include <array>
+#include <iostream>
+
+//Allocation-free counterpart of keyHandler w/ the number of fields N fixed at compile time
+//Each field gets the fewest bits holding its max, so GetKey()/InvertKey() are shifts and masks w/o any vector
+//GetDenseIndex() packs fields w/ strides (max+1), the same layout as keyHandler::GetDenseIndex, for direct positions in flat arrays
+//A field w/ max 0 takes no bits and no stride, so optional fields can stay in place at 0
+//Values are not range checked per call; use GetIsInRange() where inputs are not already bin positions
+template <unsigned int N>
+class keyPacker{
+ public:
+  typedef std::array<unsigned long long, N> keyVals;
+
+  keyPacker(){};
+  keyPacker(const keyVals& in_valMaxes){Init(in_valMaxes);}
+  ~keyPacker(){};
+
+  bool Init(const keyVals& in_valMaxes);
+
+  inline unsigned long long GetKey(const keyVals& in_vals) const;
+  template <typename... Args>
+  inline unsigned long long GetKey(Args... in_vals) const;
+  inline keyVals InvertKey(unsigned long long in_key) const;
+
+  inline unsigned long long GetDenseIndex(const keyVals& in_vals) const;
+  template <typename... Args>
+  inline unsigned long long GetDenseIndex(Args... in_vals) const;
+  inline keyVals InvertDenseIndex(unsigned long long in_index) const;
+
+  bool GetIsInit() const {return m_isInit;}
+  bool GetIsInRange(const keyVals& in_vals) const;
+  unsigned int GetNBits() const {return m_nBits;}
+  unsigned long long GetNDenseIndex() const;
+
+ private:
+  bool m_isInit = false;
+  unsigned int m_nBits = 0;
+  keyVals m_valMaxes = {};
+  keyVals m_shifts = {};
+  keyVals m_masks = {};
+  keyVals m_denseStrides = {};
+};
+
+template <unsigned int N>
+bool keyPacker<N>::Init(const keyVals& in_valMaxes)
+{
+  m_isInit = false;
+  m_nBits = 0;
+  m_valMaxes = in_valMaxes;
+
+  unsigned long long shift = 0;
+  unsigned long long stride = 1;
+  for(unsigned int fI = 0; fI < N; ++fI){
+    const unsigned long long nBits = m_valMaxes[fI] == 0 ? 0 : 64 - __builtin_clzll(m_valMaxes[fI]);
+
+    m_shifts[fI] = nBits == 0 ? 0 : shift;//keeps shifts below 64 for zero width fields
+    m_masks[fI] = nBits == 64 ? ~0ULL : (1ULL << nBits) - 1;
+    m_denseStrides[fI] = stride;
+
+    shift += nBits;
+    if(shift > 64){
+      std::cout << "keyPacker error - Given maxes need \'" << shift << "\' bits, more than 64. Initialization failed." << std::endl;
+      return false;
+    }
+
+    if(m_valMaxes[fI] + 1 == 0 || stride > (~0ULL)/(m_valMaxes[fI] + 1)){
+      std::cout << "keyPacker error - Given maxes would overflow the dense index. Initialization failed." << std::endl;
+      return false;
+    }
+    stride *= m_valMaxes[fI] + 1;
+  }
+
+  m_nBits = shift;
+  m_isInit = true;
+  return m_isInit;
+}
+
+template <unsigned int N>
+inline unsigned long long keyPacker<N>::GetKey(const keyVals& in_vals) const
+{
+  unsigned long long retVal = 0;
+  for(unsigned int fI = 0; fI < N; ++fI){
+    retVal |= in_vals[fI] << m_shifts[fI];
+  }
+  return retVal;
+}
+
+template <unsigned int N>
+template <typename... Args>
+inline unsigned long long keyPacker<N>::GetKey(Args... in_vals) const
+{
+  static_assert(sizeof...(Args) == N, "keyPacker::GetKey() takes exactly N values");
+  return GetKey(keyVals{{(unsigned long long)in_vals...}});
+}
+
+template <unsigned int N>
+inline typename keyPacker<N>::keyVals keyPacker<N>::InvertKey(unsigned long long in_key) const
+{
+  keyVals retVals;
+  for(unsigned int fI = 0; fI < N; ++fI){
+    retVals[fI] = (in_key >> m_shifts[fI]) & m_masks[fI];
+  }
+  return retVals;
+}
+
+template <unsigned int N>
+inline unsigned long long keyPacker<N>::GetDenseIndex(const keyVals& in_vals) const
+{
+  unsigned long long retVal = 0;
+  for(unsigned int fI = 0; fI < N; ++fI){
+    retVal += in_vals[fI]*m_denseStrides[fI];
+  }
+  return retVal;
+}
+
+template <unsigned int N>
+template <typename... Args>
+inline unsigned long long keyPacker<N>::GetDenseIndex(Args... in_vals) const
+{
+  static_assert(sizeof...(Args) == N, "keyPacker::GetDenseIndex() takes exactly N values");
+  return GetDenseIndex(keyVals{{(unsigned long long)in_vals...}});
+}
+
+template <unsigned int N>
+inline typename keyPacker<N>::keyVals keyPacker<N>::InvertDenseIndex(unsigned long long in_index) const
+{
+  keyVals retVals;
+  for(unsigned int fI = 0; fI < N; ++fI){
+    retVals[fI] = (in_index/m_denseStrides[fI])%(m_valMaxes[fI] + 1);
+  }
+  return retVals;
+}
+
+template <unsigned int N>
+bool keyPacker<N>::GetIsInRange(const keyVals& in_vals) const
+{
+  for(unsigned int fI = 0; fI < N; ++fI){
+    if(in_vals[fI] > m_valMaxes[fI]){
+      std::cout << "keyPacker warning - Given value \'" << in_vals[fI] << "\' exceeds corresponding max \'" << m_valMaxes[fI] << "\'" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+template <unsigned int N>
+unsigned long long keyPacker<N>::GetNDenseIndex() const
+{
+  unsigned long long retVal = 1;
+  for(unsigned int fI = 0; fI < N; ++fI){
+    retVal *= m_valMaxes[fI] + 1;
+  }
+  return retVal;
+}
+
+#endif
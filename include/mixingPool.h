@@ -0,0 +1,71 @@
+#ifndef MIXINGPOOL_H
+#define MIXINGPOOL_H
+
+//c+cpp
+#include <string>
+#include <vector>
+
+//Non-owning view of one stored event, valid until the pool is modified or cleaned
+struct mixingPoolEvent{
+  unsigned int nJets;
+  const float* pt;
+  const float* eta;
+  const float* phi;
+
+  unsigned int size() const {return nJets;}
+};
+
+//Mixed event jets stored per mixing category as flat pt/eta/phi arrays + per-event offsets
+//Categories are addressed by dense index (see keyPacker::GetDenseIndex)
+//A filled pool can be written to a library file and memory-mapped read-only by later jobs (see Write/Map)
+class mixingPool{
+ public:
+  mixingPool(){};
+  mixingPool(unsigned long long in_nCategories);
+  ~mixingPool();
+
+  bool Init(unsigned long long in_nCategories);
+  void Reserve(unsigned long long in_catPos, unsigned long long in_nEvents, unsigned long long in_nJets);
+  bool AddEvent(unsigned long long in_catPos, std::vector<float>* in_pt_p, std::vector<float>* in_eta_p, std::vector<float>* in_phi_p);
+
+  //Library file: header w/ a free-form description of how the pool was built, a category index, then each category's arrays contiguous
+  //Map() fails (w/o error) if the file is missing or was built w/ a different description; the mapped pool is read-only
+  bool Write(std::string in_fileName, std::string in_description) const;
+  bool Map(std::string in_fileName, std::string in_description);
+  bool GetIsMapped() const;
+
+  unsigned long long GetNCategories() const;
+  unsigned long long GetNEvents(unsigned long long in_catPos) const;
+  unsigned long long GetNJets() const;
+  unsigned long long GetMemoryBytes() const;
+  unsigned long long GetMappedBytes() const;
+  mixingPoolEvent GetEvent(unsigned long long in_catPos, unsigned long long in_evtPos) const;
+  void Clean();
+
+ private:
+  struct mixingCategory{
+    std::vector<float> pt;
+    std::vector<float> eta;
+    std::vector<float> phi;
+    std::vector<unsigned int> offsets;//size nEvents+1, event i is [offsets[i], offsets[i+1])
+  };
+
+  //What GetEvent() reads, pointing either into m_categories or into the mapped file
+  struct mixingCategoryView{
+    unsigned long long nEvents;
+    const unsigned int* offsets;
+    const float* pt;
+    const float* eta;
+    const float* phi;
+  };
+
+  void UpdateView(unsigned long long in_catPos);
+
+  std::vector<mixingCategory> m_categories;
+  std::vector<mixingCategoryView> m_views;
+
+  const char* m_map_p = nullptr;
+  unsigned long long m_mapBytes = 0;
+};
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef MODEDISPATCH_H
+#define MODEDISPATCH_H
+
+//c+cpp
+#include <type_traits>
+
+//Runtime mode flags -> compile-time tags, picked once before an event loop
+//modeDispatch<N>::Run(kernel, flags) calls kernel(tag_0, ..., tag_N-1), tag_i std::true_type if flags[i] else std::false_type,
+//so a kernel written as a generic lambda is instantiated once per flag combination and its flag tests fold away
+//Inside the kernel, e.g. 'const bool isMC = isMCTag;' shadows the runtime flag w/ the constant
+//RunGeneric() instead calls the kernel once w/ modeFlag stand-ins, a single instantiation testing the flags at run time,
+//i.e. the unspecialized baseline the specialized kernels are timed against
+struct modeFlag{
+  bool value;
+  operator bool() const {return value;}
+};
+
+template <unsigned int N>
+struct modeDispatch{
+  template <typename Kernel, typename... Tags>
+  static int Run(Kernel& in_kernel, const bool* in_flags, Tags... in_tags)
+  {
+    if(in_flags[0]) return modeDispatch<N-1>::Run(in_kernel, in_flags+1, in_tags..., std::true_type());
+    return modeDispatch<N-1>::Run(in_kernel, in_flags+1, in_tags..., std::false_type());
+  }
+
+  template <typename Kernel, typename... Flags>
+  static int RunGeneric(Kernel& in_kernel, const bool* in_flags, Flags... in_modeFlags)
+  {
+    return modeDispatch<N-1>::RunGeneric(in_kernel, in_flags+1, in_modeFlags..., modeFlag{in_flags[0]});
+  }
+};
+
+template <>
+struct modeDispatch<0>{
+  template <typename Kernel, typename... Tags>
+  static int Run(Kernel& in_kernel, const bool*, Tags... in_tags){return in_kernel(in_tags...);}
+
+  template <typename Kernel, typename... Flags>
+  static int RunGeneric(Kernel& in_kernel, const bool*, Flags... in_modeFlags){return in_kernel(in_modeFlags...);}
+};
+
+#endif
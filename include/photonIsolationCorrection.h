@@ -7,7 +7,8 @@
 #include <vector>
 
 //Local
-//#include "include/checkMakeDir.h"
+#include "include/binLookup.h"
+#include "include/checkMakeDir.h"
 
 class photonIsolationCorrection
 {
@@ -16,6 +17,7 @@ class photonIsolationCorrection
   photonIsolationCorrection(std::string inTableFile);
   ~photonIsolationCorrection(){};
   void SetTable(std::string inTableFile);
+  double GetCent(double inVal);
   double GetCorrectedIsolation(double inVal);
   void PrintTableTex();
   
@@ -25,6 +27,7 @@ class photonIsolationCorrection
   bool m_isInit;
   bool m_isDescending;
   std::vector<double> m_centVals;
+  thresholdLookup m_centLookup;
 };
 
 #endif
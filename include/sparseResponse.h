@@ -0,0 +1,104 @@
+#ifndef SPARSERESPONSE_H
+#define SPARSERESPONSE_H
+
+//c+cpp
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//ROOT
+#include "TDirectory.h"
+#include "TH2D.h"
+
+//Weighted response matrix stored sparse, for the flattened (photon pt, jet pt) axes of the 2D unfolding
+//Bins follow TH2 numbering, x reco and y gen, w/ 0 and n+1 as under/overflow, so a MakeTH2D() copy matches a TH2D filled the same way
+//Fill() collects entries in a hash keyed by (reco bin, gen bin); Compress() folds them into CSR rows over reco bins w/ ascending gen bins
+//Matched pairs only, as the dense h2D_genPt_recoPt it replaces; the efficiency comes from a separate truth spectrum (TRUTHHISTNAME in bayesUnfolding)
+class sparseResponse{
+ public:
+  sparseResponse(){};
+  sparseResponse(std::vector<double> in_recoEdges, std::vector<double> in_genEdges);
+  ~sparseResponse();
+
+  bool Init(std::vector<double> in_recoEdges, std::vector<double> in_genEdges);
+  //Weight < 0 fills unweighted, same as fillTH2
+  inline void Fill(double in_reco, double in_gen, double in_weight = -1.0);
+  bool Merge(const sparseResponse& in_response);
+  void Compress();
+
+  bool GetIsInit() const;
+  int GetNRecoBins() const;
+  int GetNGenBins() const;
+  const std::vector<double>& GetRecoEdges() const;
+  const std::vector<double>& GetGenEdges() const;
+  double GetBinContent(int in_recoBin, int in_genBin) const;
+  double GetBinSumW2(int in_recoBin, int in_genBin) const;
+  unsigned long long GetNNonZero() const;
+  //In-range bins only as CSR over 0-indexed reco rows and gen columns, as bayesUnfold::InitSparse takes them; false w/ uncompressed fills
+  bool GetCSR(std::vector<unsigned long long>* out_rowPtr, std::vector<int>* out_col, std::vector<double>* out_val) const;
+  //Dense copy for QA plots; the unfolding reads the CSR rows directly
+  TH2D* MakeTH2D(std::string in_name, std::string in_title = "") const;
+
+  //Stored as TVectorD objects in the subdirectory in_name of in_dir_p
+  bool Write(TDirectory* in_dir_p, std::string in_name);
+  bool Read(TDirectory* in_dir_p, std::string in_name);
+  void Clean();
+
+ private:
+  inline static int FindBin(const std::vector<double>& in_edges, double in_val);
+  inline void AddStaged(unsigned long long in_key, double in_weight, double in_weight2);
+  long long FindCompressed(int in_recoBin, int in_genBin) const;
+  //(key, position) of every compressed and staged entry
+  std::vector<std::pair<unsigned long long, unsigned long long> > GetEntries() const;
+
+  std::vector<double> m_recoEdges;
+  std::vector<double> m_genEdges;
+  int m_nRecoCols = 0;//nReco+2 w/ under/overflow
+  int m_nGenCols = 0;//nGen+2
+
+  //Not yet compressed fills; key is recoBin*m_nGenCols + genBin
+  std::unordered_map<unsigned long long, unsigned long long> m_stagedPos;
+  std::vector<unsigned long long> m_stagedKey;
+  std::vector<double> m_stagedW;
+  std::vector<double> m_stagedW2;
+
+  //CSR: reco row r holds gen bins m_col[m_rowPtr[r], m_rowPtr[r+1])
+  std::vector<unsigned long long> m_rowPtr;
+  std::vector<int> m_col;
+  std::vector<double> m_val;
+  std::vector<double> m_sumW2;
+};
+
+//TH1 bin numbering: 0 below the first edge, n+1 at or above the last
+inline int sparseResponse::FindBin(const std::vector<double>& in_edges, double in_val)
+{
+  return std::upper_bound(in_edges.begin(), in_edges.end(), in_val) - in_edges.begin();
+}
+
+inline void sparseResponse::AddStaged(unsigned long long in_key, double in_weight, double in_weight2)
+{
+  auto pos = m_stagedPos.find(in_key);
+  if(pos == m_stagedPos.end()){
+    m_stagedPos[in_key] = m_stagedKey.size();
+    m_stagedKey.push_back(in_key);
+    m_stagedW.push_back(in_weight);
+    m_stagedW2.push_back(in_weight2);
+  }
+  else{
+    m_stagedW[pos->second] += in_weight;
+    m_stagedW2[pos->second] += in_weight2;
+  }
+  return;
+}
+
+inline void sparseResponse::Fill(double in_reco, double in_gen, double in_weight)
+{
+  if(in_weight < 0) in_weight = 1.0;
+  const unsigned long long key = ((unsigned long long)FindBin(m_recoEdges, in_reco))*m_nGenCols + FindBin(m_genEdges, in_gen);
+  AddStaged(key, in_weight, in_weight*in_weight);
+  return;
+}
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef STAGETIMER_H
+#define STAGETIMER_H
+
+//c+cpp
+#include <chrono>
+#include <string>
+#include <vector>
+
+//Named stage timers and counters for the event loops, switched on by DOGLOBALTIMINGROOT via globalDebugHandler
+//Stages are registered once w/ AddStage() and then addressed by index; when off every call is one branch on a bool
+//Stages may nest, so their times are inclusive; w/ worker threads each worker keeps its own stageTimer and Merge() sums them
+class stageTimer{
+ public:
+  stageTimer(){};
+  stageTimer(bool in_doTiming);
+  ~stageTimer(){};
+
+  bool Init(bool in_doTiming);
+  int AddStage(std::string in_name);
+  //Copy of the stage list w/ zeroed times, for worker threads
+  void CopyStages(const stageTimer& in_timer);
+
+  inline void Start(int in_stage);
+  inline void Stop(int in_stage);
+  inline void Count(int in_stage, unsigned long long in_count = 1);
+  inline void CountEvents(unsigned long long in_count = 1);
+
+  bool Merge(const stageTimer& in_timer);
+  bool GetDoTiming() const;
+  double GetWallSeconds() const;
+  //Peak resident set size of the process in kB, from getrusage
+  static long GetPeakRSSKB();
+
+  //Per-stage table to stdout; in_jsonFileName, if not empty, gets the same numbers as json
+  void Print(std::string in_jsonFileName = "") const;
+  void Clean();
+
+ private:
+  bool m_doTiming = false;
+  std::chrono::steady_clock::time_point m_wallStart;
+  unsigned long long m_nEvents = 0;
+
+  std::vector<std::string> m_names;
+  std::vector<std::chrono::steady_clock::time_point> m_starts;
+  std::vector<double> m_seconds;
+  std::vector<unsigned long long> m_calls;
+  std::vector<unsigned long long> m_counts;
+};
+
+//Times a stage for the lifetime of the scope
+class stageScope{
+ public:
+  stageScope(stageTimer* in_timer_p, int in_stage) : m_timer_p(in_timer_p), m_stage(in_stage){m_timer_p->Start(m_stage);}
+  ~stageScope(){m_timer_p->Stop(m_stage);}
+
+ private:
+  stageTimer* m_timer_p;
+  int m_stage;
+};
+
+inline void stageTimer::Start(int in_stage)
+{
+  if(!m_doTiming) return;
+  m_starts[in_stage] = std::chrono::steady_clock::now();
+  return;
+}
+
+inline void stageTimer::Stop(int in_stage)
+{
+  if(!m_doTiming) return;
+  m_seconds[in_stage] += std::chrono::duration<double>(std::chrono::steady_clock::now() - m_starts[in_stage]).count();
+  ++(m_calls[in_stage]);
+  return;
+}
+
+inline void stageTimer::Count(int in_stage, unsigned long long in_count)
+{
+  if(!m_doTiming) return;
+  m_counts[in_stage] += in_count;
+  return;
+}
+
+inline void stageTimer::CountEvents(unsigned long long in_count)
+{
+  if(!m_doTiming) return;
+  m_nEvents += in_count;
+  return;
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef SYSDELTAPACK_H
+#define SYSDELTAPACK_H
+
+//c+cpp
+#include <string>
+#include <vector>
+
+//ROOT
+#include "TTree.h"
+
+//Systematic pt variations of a set of objects (jets, photons) packed into one branch in place of one full float vector per variation
+//Branch <name> is a std::vector<Short_t> of nObjects x nVar quantized relative deltas, object-major, w/ the nominal pt vector kept as is:
+//  pt(object o, variation v) = ptNominal[o]*(1 + q[o*nVar + v]*step), step = 2*maxRelErr
+//so rounding moves a variation by at most maxRelErr*ptNominal; deltas beyond +-32767*step are clamped and counted
+//<name>_nVar and <name>_step are per-entry scalars (constant within a file) so a reader needs no config
+class sysDeltaPack{
+ public:
+  sysDeltaPack(){};
+  ~sysDeltaPack();
+
+  //Write side
+  bool Init(unsigned int in_nVar, double in_maxRelErr);
+  void Branch(TTree* in_tree_p, std::string in_name);
+  //Variation vectors in packing order, each the size of the nominal
+  bool Pack(const std::vector<float>* in_nom_p, const std::vector<std::vector<float>**>& in_vars);
+  void PrintErrors(std::string in_label) const;
+  double GetMaxAbsErr() const {return m_maxAbsErr;}
+  double GetMaxRelErr() const {return m_maxRelErrSeen;}
+  ULong64_t GetNClamped() const {return m_nClamped;}
+
+  //Read side, in_reader_p a TTree or a columnarTreeReader
+  template <typename READER>
+  void SetBranchAddress(READER* in_reader_p, std::string in_name);
+  unsigned int GetNVar() const {return m_nVar;}
+  float GetPt(const std::vector<float>* in_nom_p, unsigned int in_objPos, unsigned int in_varPos) const;
+  //Rebuilds the full pt vector of variation in_varPos, false if the packed entry does not match the nominal size
+  bool Unpack(unsigned int in_varPos, const std::vector<float>* in_nom_p, std::vector<float>* out_pt_p) const;
+
+  static std::string GetNVarName(std::string in_name){return in_name + "_nVar";}
+  static std::string GetStepName(std::string in_name){return in_name + "_step";}
+
+ private:
+  Int_t m_nVar = 0;
+  Float_t m_step = 0.0;
+  std::vector<Short_t>* m_packed_p = nullptr;
+  bool m_ownsPacked = false;
+
+  double m_maxAbsErr = 0.0;
+  double m_maxRelErrSeen = 0.0;
+  ULong64_t m_nPacked = 0;
+  ULong64_t m_nClamped = 0;
+};
+
+template <typename READER>
+void sysDeltaPack::SetBranchAddress(READER* in_reader_p, std::string in_name)
+{
+  in_reader_p->SetBranchAddress(in_name.c_str(), &m_packed_p);
+  in_reader_p->SetBranchAddress(GetNVarName(in_name).c_str(), &m_nVar);
+  in_reader_p->SetBranchAddress(GetStepName(in_name).c_str(), &m_step);
+  return;
+}
+
+#endif
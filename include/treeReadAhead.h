@@ -0,0 +1,35 @@
+#ifndef TREEREADAHEAD_H
+#define TREEREADAHEAD_H
+
+//c+cpp
+#include <string>
+#include <vector>
+
+//ROOT
+#include "TTree.h"
+
+//Read-ahead for the event loops, set up after the branch status/address calls and right before the loop
+//Gives the tree an explicitly sized TTreeCache holding only the enabled branches (learning phase skipped), limited to the entries the loop reads
+//W/ EnableAsyncUnzip() the cache is a TTreeCacheUnzip: while the loop works on the current cluster, ROOT's thread pool
+//decompresses the baskets of the cached cluster ahead of it, and GetEntry() unpacks the branches of an entry in parallel
+class treeReadAhead{
+ public:
+  treeReadAhead(){};
+  ~treeReadAhead(){};
+
+  //Once per process, before the first Init(); 0 threads leaves decompression on the reading thread
+  static bool EnableAsyncUnzip(unsigned int in_nThreads);
+
+  //in_entryEnd is exclusive, -1 for the whole tree; in_cacheMB <= 0 leaves the ROOT default cache untouched
+  bool Init(TTree* in_tree_p, Long64_t in_cacheMB, Long64_t in_entryStart = 0, Long64_t in_entryEnd = -1);
+  unsigned int GetNCachedBranches() const;
+  void PrintStats() const;
+  void Clean();
+
+ private:
+  TTree* m_tree_p = nullptr;
+  Long64_t m_cacheMB = 0;
+  std::vector<std::string> m_branches;
+};
+
+#endif
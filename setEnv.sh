@@ -14,3 +14,4 @@ else
     echo "GDJDIR given, '$GDJDIR' not found!!! Please fix" 
 fi
 export DOGLOBALDEBUGROOT=0
+export DOGLOBALTIMINGROOT=0